@@ -23,5 +23,8 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.*
 FREESTEAM_DLL double freesteam_b23_p_T(double T);
 FREESTEAM_DLL double freesteam_b23_T_p(double p);
 
+/* freesteam_b23_p_T(REGION1_TMAX), the lowest pressure of region 3 */
+#define B23_PMIN 16529164.252621626 /* Pa */
+
 #endif
 
@@ -23,6 +23,10 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 FREESTEAM_DLL double freesteam_region1_T_ph(double p, double h);
 FREESTEAM_DLL double freesteam_region2_T_ph(double p, double h);
+
+/* batch versions of the above for n states, see common.h */
+FREESTEAM_DLL void freesteam_region1_T_ph_batch(int n, const double *p, const double *h, double *T);
+FREESTEAM_DLL void freesteam_region2_T_ph_batch(int n, const double *p, const double *h, double *T);
 FREESTEAM_DLL double freesteam_region3_T_ph(double p, double h);
 FREESTEAM_DLL double freesteam_region3_v_ph(double p, double h);
 FREESTEAM_DLL double freesteam_region3_psat_h(double h);
@@ -31,5 +35,7 @@ FREESTEAM_DLL double freesteam_region3_psat_s(double s);
 FREESTEAM_DLL double freesteam_region3_T_ps(double p, double h);
 FREESTEAM_DLL double freesteam_region3_v_ps(double p, double h);
 
+FREESTEAM_DLL double freesteam_region3_v_pT(double p, double T);
+
 #endif
 
@@ -27,6 +27,115 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 #define SQ(X) ((X)*(X))
 #define CUBE(X) ((X)*(X)*(X))
 
+/* term n x^I y^J of a backwards equation */
+typedef struct{
+	int I, J;
+	double n;
+} BackwardsData;
+
+/*
+	Sum of the N terms n x^I y^J of the coefficient table D, sorted by I
+	and then J, expanded at compile time.
+
+	The terms are summed in the nested (Horner) form
+
+		x^I0 (y^J0 (n0 + y^(J1-J0) (n1 + ...)) + x^(Ik-I0) (y^Jk (nk + ...) + ...))
+
+	with one nested polynomial in y for each value of I, and the powers of
+	x and y by unrolled repeated squaring, so that there are no calls of
+	ipow, no loops and no branches on the data. D has to be a constexpr
+	table with internal linkage.
+
+	With FREESTEAM_NO_HORNER the terms are summed by a loop over the table
+	instead, as in the original freesteam.
+*/
+#ifndef FREESTEAM_NO_HORNER
+
+/* x^N for a constant N */
+template<int N, bool Negative = (N < 0)>
+struct BackwardsPow{
+	static inline double eval(double x){
+		return N % 2
+			? x*BackwardsPow<N/2>::eval(x*x)
+			: BackwardsPow<N/2>::eval(x*x);
+	}
+};
+
+template<>
+struct BackwardsPow<0, false>{
+	static inline double eval(double){return 1.;}
+};
+
+template<>
+struct BackwardsPow<1, false>{
+	static inline double eval(double x){return x;}
+};
+
+template<int N>
+struct BackwardsPow<N, true>{
+	static inline double eval(double x){return 1./BackwardsPow<-N>::eval(x);}
+};
+
+/* index past the last term of D with the same I as term K */
+constexpr int backwards_row_end(const BackwardsData *D, int K, int N){
+	return K + 1 < N && D[K + 1].I == D[K].I ? backwards_row_end(D, K + 1, N) : K + 1;
+}
+
+/* nk + y^(Jk+1-Jk) (nk+1 + ...) over the terms K..E-1 of a row */
+template<const BackwardsData *D, int K, int E, bool Last = (K + 1 == E)>
+struct BackwardsRow{
+	static inline double eval(double y){
+		return D[K].n + BackwardsPow<D[K + 1].J - D[K].J>::eval(y)*BackwardsRow<D, K + 1, E>::eval(y);
+	}
+};
+
+template<const BackwardsData *D, int K, int E>
+struct BackwardsRow<D, K, E, true>{
+	static inline double eval(double){return D[K].n;}
+};
+
+/* y^JK (row from K) + x^(IE-IK) (rows from E) over the rows from K */
+template<const BackwardsData *D, int K, int N
+	, int E = backwards_row_end(D, K, N), bool Last = (E == N)
+>
+struct BackwardsRows{
+	static inline double eval(double x, double y){
+		return BackwardsPow<D[K].J>::eval(y)*BackwardsRow<D, K, E>::eval(y)
+			+ BackwardsPow<D[E].I - D[K].I>::eval(x)*BackwardsRows<D, E, N>::eval(x, y);
+	}
+};
+
+template<const BackwardsData *D, int K, int N, int E>
+struct BackwardsRows<D, K, N, E, true>{
+	static inline double eval(double, double y){
+		return BackwardsPow<D[K].J>::eval(y)*BackwardsRow<D, K, E>::eval(y);
+	}
+};
+
+template<const BackwardsData *D, int N>
+inline double backwards_sum(double x, double y){
+	return BackwardsPow<D[0].I>::eval(x)*BackwardsRows<D, 0, N>::eval(x, y);
+}
+
+# define BACKWARDS_SUM(D, X, Y) \
+	backwards_sum<D, sizeof(D)/sizeof(BackwardsData)>((X), (Y))
+
+#else
+
+FREESTEAM_INLINE double backwards_sum(const BackwardsData *d, unsigned n, double x, double y){
+	const BackwardsData *e = d + n;
+	double sum = 0;
+	for(; d < e; ++d){
+		sum += d->n * freesteam_ipow(x, d->I) * freesteam_ipow(y, d->J);
+	}
+	return sum;
+}
+
+# define BACKWARDS_SUM(D, X, Y) \
+	backwards_sum(D, sizeof(D)/sizeof(BackwardsData), (X), (Y))
+
+#endif
+
 /* boundary between subregions 3a and 3b in region 3 for (p,h) */
 
 #define REGION3_B3AB_PSTAR (1.e6)
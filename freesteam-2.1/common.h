@@ -79,9 +79,181 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 #define SQ(X) ((X)*(X))
 
+/*
+	Properties of a single-phase state, evaluated together from one sweep
+	over the coefficients of the fundamental equation of its region. See
+	freesteam_region1_props_pT, freesteam_region2_props_pT and
+	freesteam_region3_props_rhoT.
+*/
+typedef struct SteamProps_struct{
+	double p, T, rho, v;
+	double u, h, s, cp, cv, w;
+	double alphav; /* isobaric cubic expansivity, 1/v (dv/dT)_p */
+	double kappaT; /* isothermal compressibility, -1/v (dv/dp)_T */
+} SteamProps;
+
+/*
+	Batch kernels evaluate n states given as separate arrays (structure of
+	arrays), looping over the coefficients outside and over a block of
+	FREESTEAM_BATCH_BLOCK states inside so that the inner loops vectorise.
+
+	With GCC on x86-64 Linux each kernel is compiled for AVX-512, AVX2 and
+	the baseline instruction set and the version matching the processor is
+	selected when the library is loaded; elsewhere, or when built with
+	FREESTEAM_NO_MULTIVERSION, only the baseline version is compiled.
+*/
+#define FREESTEAM_BATCH_BLOCK 32
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) \
+	&& defined(__linux__) && !defined(FREESTEAM_NO_MULTIVERSION)
+# define FREESTEAM_MULTIVERSION
+# define FREESTEAM_BATCH __attribute__((target_clones("avx512f","avx2","default")))
+#else
+# define FREESTEAM_BATCH
+#endif
+
+/* helpers of the kernels, inlined so that they share their instruction set */
+#ifdef __GNUC__
+# define FREESTEAM_INLINE static inline __attribute__((always_inline))
+#else
+# define FREESTEAM_INLINE static inline
+#endif
+
+/*
+	Output arrays of the batch property kernels, see
+	freesteam_region1_props_pT_batch and freesteam_region2_props_pT_batch.
+*/
+typedef struct SteamPropsBatch_struct{
+	double *rho, *h, *cp, *cv, *alphav, *kappaT;
+} SteamPropsBatch;
+
+/* instruction set used by the batch kernels on this processor */
+FREESTEAM_DLL const char *freesteam_batch_isa(void);
+
 /* Basic math routines, if necesary... */
 
 FREESTEAM_DLL double freesteam_ipow(double x, int n);
+FREESTEAM_DLL void freesteam_ipow_range(double x, int nmin, int nmax, double *xn);
+
+/*
+	Powers nmin..nmax of each of the m <= FREESTEAM_BATCH_BLOCK values of x,
+	stored row by row: xn[(k - nmin)*FREESTEAM_BATCH_BLOCK + i] = x[i]^k.
+*/
+FREESTEAM_INLINE void freesteam_ipow_rows(int m, const double *x, int nmin, int nmax, double *xn){
+	double *x0 = xn - nmin*FREESTEAM_BATCH_BLOCK;
+	int i, k;
+
+	for(i = 0; i < m; ++i) x0[i] = 1.0;
+	for(k = 1; k <= nmax; ++k){
+		double *xk = x0 + k*FREESTEAM_BATCH_BLOCK;
+		for(i = 0; i < m; ++i) xk[i] = xk[i - FREESTEAM_BATCH_BLOCK] * x[i];
+	}
+
+	if(nmin < 0){
+		double xi[FREESTEAM_BATCH_BLOCK];
+		for(i = 0; i < m; ++i) xi[i] = 1.0/x[i];
+		for(k = -1; k >= nmin; --k){
+			double *xk = x0 + k*FREESTEAM_BATCH_BLOCK;
+			for(i = 0; i < m; ++i) xk[i] = xk[i + FREESTEAM_BATCH_BLOCK] * xi[i];
+		}
+	}
+}
+
+/*
+	Exponential and natural logarithm for the loops of the batch kernels,
+	which vectorise only without calls and without branches on floating
+	point values (which would have to be executed speculatively), so the
+	clamping and the range reductions are done on the bits.
+
+	freesteam_exp(x) is accurate to about 1 ulp for |x| <= 708, larger
+	arguments are clamped to +-708; freesteam_log(x) is accurate to about
+	1 ulp for positive normal x.  Neither propagates NaN.
+*/
+typedef union{double d; unsigned long long u;} FreesteamBits;
+
+/* c ? a : b on the bits, for the same reason */
+FREESTEAM_INLINE double freesteam_select(unsigned long long c, double a, double b){
+	FreesteamBits x, y;
+	x.d = a;
+	y.d = b;
+	c = -c;
+	x.u = (x.u & c) | (y.u & ~c);
+	return x.d;
+}
+
+FREESTEAM_INLINE double freesteam_exp(double x){
+	const double shift = 6755399441055744.0; /* 1.5*2^52 */
+	const double ln2hi = 6.93147180369123816490e-01, ln2lo = 1.90821492927058770002e-10;
+	FreesteamBits b, t, e;
+	unsigned long long sign, a;
+	double k, r;
+
+	/* |x| clamped to 708, the bits of positive doubles are in order */
+	b.d = x;
+	sign = b.u & 0x8000000000000000ULL;
+	a = b.u ^ sign;
+	a = a < 0x4086200000000000ULL ? a : 0x4086200000000000ULL;
+	b.u = a | sign;
+	x = b.d;
+
+	/* x = k ln2 + r with |r| <= ln2/2, k in the low bits of t */
+	t.d = x * 1.44269504088896338700 + shift;
+	k = t.d - shift;
+	r = (x - k * ln2hi) - k * ln2lo;
+
+	/* Taylor polynomial of degree 13 */
+	e.d = 1./6227020800 + r*(1./87178291200);
+	e.d = 1./479001600 + r*e.d;
+	e.d = 1./39916800 + r*e.d;
+	e.d = 1./3628800 + r*e.d;
+	e.d = 1./362880 + r*e.d;
+	e.d = 1./40320 + r*e.d;
+	e.d = 1./5040 + r*e.d;
+	e.d = 1./720 + r*e.d;
+	e.d = 1./120 + r*e.d;
+	e.d = 1./24 + r*e.d;
+	e.d = 1./6 + r*e.d;
+	e.d = 0.5 + r*e.d;
+	e.d = 1. + r*e.d;
+	e.d = 1. + r*e.d;
+
+	/* times 2^k, added to the exponent */
+	e.u += t.u << 52;
+	return e.d;
+}
+
+FREESTEAM_INLINE double freesteam_log(double x){
+	const double shift = 6755399441055744.0; /* 1.5*2^52 */
+	const double ln2hi = 6.93147180369123816490e-01, ln2lo = 1.90821492927058770002e-10;
+	FreesteamBits b, e, m;
+	unsigned long long big;
+	double s, s2, p;
+
+	/* x = m 2^e with m in [sqrt(1/2), sqrt(2)) */
+	b.d = x;
+	m.u = (b.u & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+	big = m.u > 0x3ff6a09e667f3bcdULL;
+	m.u -= big << 52;
+	e.u = ((b.u >> 52) + big) | 0x4338000000000000ULL;
+	e.d -= shift + 1023;
+
+	/* log(m) = 2 atanh(s) with |s| <= 0.1716, series to s^25 */
+	s = (m.d - 1.)/(m.d + 1.);
+	s2 = s*s;
+	p = 1./23 + s2*(1./25);
+	p = 1./21 + s2*p;
+	p = 1./19 + s2*p;
+	p = 1./17 + s2*p;
+	p = 1./15 + s2*p;
+	p = 1./13 + s2*p;
+	p = 1./11 + s2*p;
+	p = 1./9 + s2*p;
+	p = 1./7 + s2*p;
+	p = 1./5 + s2*p;
+	p = 1./3 + s2*p;
+
+	return e.d*ln2hi + (2.*s + (2.*s*s2*p + e.d*ln2lo));
+}
 
 #ifdef FREESTEAM_BUILDING_LIB
 /* our local ipow implementation */
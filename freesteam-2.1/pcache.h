@@ -0,0 +1,48 @@
+/*
+freesteam - IAPWS-IF97 steam tables library
+Copyright (C) 2004-2009  John Pye
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+#ifndef FREESTEAM_PCACHE_H
+#define FREESTEAM_PCACHE_H
+
+#include "common.h"
+
+/*
+	Values of the region boundaries at a pressure p, cached per thread for
+	the last pressure they were asked for, so that the states of a pressure
+	level, e.g. the cells of a layer or the iterations of a solver at fixed
+	p, evaluate them once. The cache is keyed on the exact value of p.
+
+	Tsat(p) is defined up to the critical pressure, the saturated liquid and
+	vapour values at Tsat(p) for p <= REGION4_P13 only, and the values at the
+	region 1-3 and 2-3 boundaries, at REGION1_TMAX and T23(p), above it.
+*/
+FREESTEAM_DLL double freesteam_pcache_Tsat(double p);
+FREESTEAM_DLL double freesteam_pcache_hf(double p);
+FREESTEAM_DLL double freesteam_pcache_hg(double p);
+FREESTEAM_DLL double freesteam_pcache_uf(double p);
+FREESTEAM_DLL double freesteam_pcache_ug(double p);
+
+FREESTEAM_DLL double freesteam_pcache_h13(double p);
+FREESTEAM_DLL double freesteam_pcache_u13(double p);
+
+FREESTEAM_DLL double freesteam_pcache_T23(double p);
+FREESTEAM_DLL double freesteam_pcache_h23(double p);
+FREESTEAM_DLL double freesteam_pcache_u23(double p);
+
+#endif
+
@@ -36,6 +36,13 @@ FREESTEAM_DLL double freesteam_region1_g_pT(double p, double T);
 double freesteam_region1_alphav_pT(double p, double T);
 double freesteam_region1_kappaT_pT(double p, double T);
 
+/* all of the above from a single sweep of the coefficients */
+FREESTEAM_DLL SteamProps freesteam_region1_props_pT(double p, double T);
+
+/* batch versions for n states, see common.h */
+FREESTEAM_DLL void freesteam_region1_props_pT_batch(int n, const double *p, const double *T, SteamPropsBatch P);
+FREESTEAM_DLL void freesteam_region1_h_pT_batch(int n, const double *p, const double *T, double *h);
+
 #define REGION1_TMAX 623.15 /* K */
 
 #endif
@@ -38,5 +38,15 @@ FREESTEAM_DLL double freesteam_region2_g_pT(double p, double T);
 double freesteam_region2_alphav_pT(double p, double T);
 double freesteam_region2_kappaT_pT(double p, double T);
 
+/* all of the above from a single sweep of the coefficients */
+FREESTEAM_DLL SteamProps freesteam_region2_props_pT(double p, double T);
+
+/* h and cp = (dh/dT)_p only, from a single sweep, for Newton iteration on h */
+FREESTEAM_DLL void freesteam_region2_h_cp_pT(double p, double T, double *h, double *cp);
+
+/* batch versions for n states, see common.h */
+FREESTEAM_DLL void freesteam_region2_props_pT_batch(int n, const double *p, const double *T, SteamPropsBatch P);
+FREESTEAM_DLL void freesteam_region2_h_pT_batch(int n, const double *p, const double *T, double *h);
+
 #endif
 
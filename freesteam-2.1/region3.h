@@ -34,6 +34,12 @@ FREESTEAM_DLL double freesteam_region3_w_rhoT(double rho, double T);
 double freesteam_region3_alphap_rhoT(double rho, double T);
 double freesteam_region3_betap_rhoT(double rho, double T);
 
+/* all of the above from a single sweep of the coefficients */
+FREESTEAM_DLL SteamProps freesteam_region3_props_rhoT(double rho, double T);
+
+/* p and (dp/drho)_T only, from a single sweep, for Newton iteration on p */
+FREESTEAM_DLL double freesteam_region3_p_dpdrho_rhoT(double rho, double T, double *dpdrho);
+
 #endif
 
 
@@ -25,6 +25,10 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 FREESTEAM_DLL double freesteam_region4_psat_T(double T);
 FREESTEAM_DLL double freesteam_region4_Tsat_p(double p);
 
+/* batch versions of the above for n states, see common.h */
+FREESTEAM_DLL void freesteam_region4_psat_T_batch(int n, const double *T, double *p);
+FREESTEAM_DLL void freesteam_region4_Tsat_p_batch(int n, const double *p, double *T);
+
 FREESTEAM_DLL double freesteam_region4_rhof_T(double T);
 FREESTEAM_DLL double freesteam_region4_rhog_T(double T);
 
@@ -37,5 +41,9 @@ FREESTEAM_DLL double freesteam_region4_cv_Tx(double T, double x);
 
 FREESTEAM_DLL double freesteam_region4_dpsatdT_T(double T);
 
+/* freesteam_region4_psat_T(REGION1_TMAX), the pressure above which the
+   region 1 and region 2 boundaries are the region 3 ones */
+#define REGION4_P13 16529164.252604481 /* Pa */
+
 #endif
 
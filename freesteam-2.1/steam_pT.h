@@ -25,5 +25,27 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 FREESTEAM_DLL SteamState freesteam_set_pT(double p, double T);
 
+/* As freesteam_set_pT, with the status of freesteam_region3_rho_pT for the
+   region 3 states and 0 for the others, if status is not NULL */
+FREESTEAM_DLL SteamState freesteam_set_pT_status(double p, double T, int *status);
+
+FREESTEAM_DLL int freesteam_region_pT(double p, double T);
+
+/*
+	Density in region 3 for (p,T), from the IAPWS backward equations v(p,T)
+	of the region 3 sub-regions (freesteam_region3_v_pT) with one Newton
+	step on p(rho,T), (dp/drho)_T coming from the same sweep of the
+	Helmholtz function (see freesteam_region3_p_dpdrho_rhoT). The relative
+	error against the density from the basic equation is below 1e-5 except
+	within 1 K of the critical point and the saturation line, and up to
+	2e-2 within 0.01 K of the critical point.
+
+	The step is not taken where (dp/drho)_T is not positive or where it
+	would exceed the density, e.g. for NaN or for states far outside region
+	3. The backward density is then returned, and *status, if status is not
+	NULL, is set to 1; it is 0 otherwise.
+*/
+FREESTEAM_DLL double freesteam_region3_rho_pT(double p, double T, int *status);
+
 #endif
 
@@ -26,8 +26,65 @@ FREESTEAM_DLL int freesteam_bounds_ph(double p, double h, int verbose);
 
 FREESTEAM_DLL int freesteam_region_ph(double p, double h);
 
+/* batch version for n states, see common.h */
+FREESTEAM_DLL void freesteam_region_ph_batch(int n, const double *p, const double *h, int *region);
+
 FREESTEAM_DLL SteamState freesteam_set_ph(double p, double h);
 
+/*
+	Temperature in region 2 for (p,h), by Newton iteration on h(p,T) with
+	cp = (dh/dT)_p from the same sweep of the Gibbs function, started from
+	the backward equation. If an iterate leaves the +/-0.1 % bracket around
+	the starting point, or has not converged after
+	FREESTEAM_REGION2_PH_MAXITER iterations, the temperature is found by
+	bracketing (zeroin) instead.
+
+	If niter is not NULL it returns the number of evaluations of h(p,T), or
+	-1 if the bracketing solver was used.
+*/
+#define FREESTEAM_REGION2_PH_MAXITER 8
+#define FREESTEAM_REGION2_PH_TOL 1e-9 /* relative temperature step */
+
+FREESTEAM_DLL double freesteam_region2_T_ph_solve(double p, double h, int *niter);
+
+/*
+	Batch version of the above for n states, also returning the properties
+	at the solved temperatures (see common.h). Converged states keep the
+	temperature of their last evaluation, so that the properties belong to
+	it.
+*/
+FREESTEAM_DLL void freesteam_region2_T_ph_solve_batch(int n, const double *p, const double *h, double *T, SteamPropsBatch P, int *niter);
+
+/*
+	The Newton iteration of the above alone, started from the temperatures
+	in T, for example those of a previous solution. States that leave the
+	+/-0.1 % bracket around their starting point or do not converge are
+	returned with niter[i] = -1, and T and the properties undefined.
+*/
+FREESTEAM_DLL void freesteam_region2_T_ph_newton_batch(int n, const double *p, const double *h, double *T, SteamPropsBatch P, int *niter);
+
+/*
+	Density and temperature in region 3 for (p,h), by Newton iteration on
+	p(rho,T) and h(rho,T) with the Jacobian from the analytic derivatives of
+	the Helmholtz function (see freesteam_region3_props_rhoT), started from
+	the backward equations v(p,h) and T(p,h). The iteration stops after a
+	relative step below FREESTEAM_REGION3_PH_TOL, which by its quadratic
+	convergence leaves a relative error in p and h below 1e-10, mostly
+	after two iterations; the backward equations alone leave about 1e-4.
+
+	If an iterate leaves the bracket of FREESTEAM_REGION3_PH_BRACKET
+	(relative) around the starting point, for example where (dp/drho)_T
+	vanishes at the critical point, or has not converged after
+	FREESTEAM_REGION3_PH_MAXITER iterations, rho and T are those of the
+	backward equations and -1 is returned. Otherwise the number of
+	evaluations of the Helmholtz function is returned.
+*/
+#define FREESTEAM_REGION3_PH_MAXITER 6
+#define FREESTEAM_REGION3_PH_TOL 1e-6 /* relative density and temperature step */
+#define FREESTEAM_REGION3_PH_BRACKET 0.02
+
+FREESTEAM_DLL int freesteam_region3_rhoT_ph_solve(double p, double h, double *rho, double *T);
+
 
 #endif
 
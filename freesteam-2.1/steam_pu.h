@@ -0,0 +1,66 @@
+/*
+freesteam - IAPWS-IF97 steam tables library
+Copyright (C) 2004-2009  John Pye
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+*/
+#ifndef FREESTEAM_STEAMPU_H
+#define FREESTEAM_STEAMPU_H
+
+#include "common.h"
+#include "steam.h"
+
+FREESTEAM_DLL int freesteam_region_pu(double p, double u);
+
+FREESTEAM_DLL SteamState freesteam_set_pu(double p, double u);
+
+/*
+	Temperature in region 1 or 2 for (p,u), by Newton iteration on u(p,T)
+	with (du/dT)_p = cp - p v alphav from the same sweep of the Gibbs
+	function. The iteration starts from the backward equation T(p,h) at
+	h = u + p v, with v evaluated twice from the boundary temperature of
+	the region, which leaves mostly two or three iterations. If an iterate
+	leaves the region or has not converged after FREESTEAM_PU_MAXITER
+	iterations, the temperature is found by bracketing (zeroin) instead.
+
+	If niter is not NULL it returns the number of evaluations of u(p,T), or
+	-1 if the bracketing solver was used.
+*/
+#define FREESTEAM_PU_MAXITER 8
+#define FREESTEAM_PU_TOL 1e-9 /* relative temperature step */
+
+FREESTEAM_DLL double freesteam_region1_T_pu_solve(double p, double u, int *niter);
+
+FREESTEAM_DLL double freesteam_region2_T_pu_solve(double p, double u, int *niter);
+
+/*
+	Density and temperature in region 3 for (p,u), by Newton iteration on
+	p(rho,T) and u(rho,T) with the Jacobian from the analytic derivatives
+	of the Helmholtz function, (du/drho)_T = (p - T (dp/dT)_rho)/rho^2 and
+	(du/dT)_rho = cv, started from the backward equations v(p,h) and T(p,h)
+	at h = u + p v.
+
+	If an iterate leaves the bracket of FREESTEAM_REGION3_PU_BRACKET
+	(relative) around the starting point or has not converged after
+	FREESTEAM_PU_MAXITER iterations, the state is found by bracketing the
+	enthalpy of (p,u) between the region 1-3 and 2-3 boundaries with
+	freesteam_set_ph, and -1 is returned. Otherwise the number of
+	evaluations of the Helmholtz function is returned.
+*/
+#define FREESTEAM_REGION3_PU_BRACKET 0.05
+
+FREESTEAM_DLL int freesteam_region3_rhoT_pu_solve(double p, double u, double *rho, double *T);
+
+#endif
@@ -34,5 +34,8 @@
 */
 FREESTEAM_DLL double freesteam_k_rhoT(double rho, double T);
 
+/* batch version for n states, see common.h */
+FREESTEAM_DLL void freesteam_k_rhoT_batch(int n, const double *rho, const double *T, double *k);
+
 #endif
 
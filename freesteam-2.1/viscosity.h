@@ -28,4 +28,7 @@
 
 FREESTEAM_DLL double freesteam_mu_rhoT(double rho, double T);
 
+/* batch version for n states, see common.h */
+FREESTEAM_DLL void freesteam_mu_rhoT_batch(int n, const double *rho, const double *T, double *mu);
+
 #endif
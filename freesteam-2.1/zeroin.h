@@ -61,5 +61,23 @@ typedef double ZeroInSubjectFunction(double, void *user_data);
 
 FREESTEAM_DLL char zeroin_solve(ZeroInSubjectFunction *func, void *user_data, double lowerbound, double upperbound, double tol, double *solution, double *error);
 
+/**
+	Tally of the zeroin_solve calls made by a thread, for instrumentation.
+	iterations[i] counts the calls that took i iterations, the last bin
+	those that took ZEROIN_NBINS - 1 or more.
+*/
+#define ZEROIN_NBINS 16
+
+typedef struct ZeroInTally_struct{
+	long calls;
+	long iterations[ZEROIN_NBINS];
+} ZeroInTally;
+
+/**
+	Return the tally of the zeroin_solve calls made by the calling thread
+	since the last call of this function, and reset it.
+*/
+FREESTEAM_DLL ZeroInTally zeroin_tally(void);
+
 #endif
 